@@ -2,6 +2,7 @@
 #include "cli/display.h"
 #include "cli/input.h"
 #include "cli/handlers.h"
+#include "categorizer/categorizer.h"
 #include <iostream>
 #include <iomanip>
 #include <limits>
@@ -28,7 +29,13 @@ int main() {
         return 1;
     }
     
+    // Optional categorization rules, see finance::load_rules for the format
+    const char* rules_path = std::getenv("FINANCE_RULES_FILE");
+
     try {
+        finance::Categorizer categorizer(
+            rules_path ? finance::load_rules(rules_path) : std::vector<finance::Rule>{});
+
         finance::Database db(conn_str);
         db.initialize();
         
@@ -43,13 +50,13 @@ int main() {
             
             switch (choice) {
                 case 1:
-                    cli_handlers::add_entry(db, current_month, "expense");
+                    cli_handlers::add_entry(db, current_month, "expense", &categorizer);
                     break;
                 case 2:
-                    cli_handlers::add_entry(db, current_month, "income");
+                    cli_handlers::add_entry(db, current_month, "income", &categorizer);
                     break;
                 case 3:
-                    cli_handlers::add_entry(db, current_month, "account_state");
+                    cli_handlers::add_entry(db, current_month, "account_state", &categorizer);
                     break;
                 case 4:
                     cli_handlers::handle_edit_entry(db, current_month);
@@ -61,6 +68,9 @@ int main() {
                     cli::view_entries(db, current_month);
                     break;
                 case 7:
+                    cli_handlers::auto_categorize(db, categorizer, current_month);
+                    break;
+                case 8:
                     std::cout << "Goodbye!" << std::endl;
                     return 0;
                 default:
@@ -13,7 +13,8 @@ namespace cli {
         std::cout << "4. Edit Entry" << std::endl;
         std::cout << "5. View Month Summary" << std::endl;
         std::cout << "6. View All Entries" << std::endl;
-        std::cout << "7. Exit" << std::endl;
+        std::cout << "7. Auto-categorize Entries" << std::endl;
+        std::cout << "8. Exit" << std::endl;
         std::cout << "\nChoice: ";
     }
 
@@ -79,6 +80,23 @@ namespace cli {
         } else {
             std::cout << " ✗" << std::endl;
         }
+
+        auto totals = db.get_category_totals(month);
+        if (totals.empty()) {
+            return;
+        }
+
+        std::cout << "\n" << std::left << std::setw(30) << "Category"
+                  << std::right << std::setw(14) << "Income"
+                  << std::setw(14) << "Expenses" << std::endl;
+        std::cout << std::string(58, '-') << std::endl;
+
+        for (const auto& total : totals) {
+            std::cout << std::left << std::setw(30)
+                      << (total.category.empty() ? "(uncategorized)" : total.category)
+                      << std::right << std::setw(14) << total.income
+                      << std::setw(14) << total.expenses << std::endl;
+        }
     }
 
     void view_entries(finance::Database& db, const std::string& month) {
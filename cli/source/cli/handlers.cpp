@@ -1,11 +1,14 @@
 #include "database/database.h"
+#include "categorizer/categorizer.h"
 #include "cli/display.h"
 #include "cli/input.h"
+#include <algorithm>
 #include <iostream>
 
 namespace cli_handlers {
 
-    void add_entry(finance::Database& db, const std::string& month, const std::string& type) {
+    void add_entry(finance::Database& db, const std::string& month, const std::string& type,
+            const finance::Categorizer* categorizer) {
         std::string name;
         double value;
         
@@ -21,13 +24,44 @@ namespace cli_handlers {
             return;
         }
         
-        if (db.add_entry(month, type, name, value)) {
+        std::string category;
+        if (categorizer) {
+            category = categorizer->classify(name, value);
+        }
+
+        if (db.add_entry(month, type, name, value, category)) {
             std::cout << "✓ " << type << " added successfully!" << std::endl;
         } else {
             std::cout << "✗ Failed to add " << type << std::endl;
         }
     }
 
+    void auto_categorize(finance::Database& db, const finance::Categorizer& categorizer,
+            const std::string& month) {
+
+        if (categorizer.empty()) {
+            std::cout << "No categorization rules loaded. Set FINANCE_RULES_FILE to a rules file." << std::endl;
+            return;
+        }
+
+        auto entries = db.get_entries_by_month(month);
+        if (entries.empty()) {
+            std::cout << "\nNo entries found for this month." << std::endl;
+            return;
+        }
+
+        auto categories = categorizer.classify_all(entries.entries());
+        std::size_t matched = std::count_if(categories.begin(), categories.end(),
+                [](std::string_view category) { return !category.empty(); });
+
+        if (db.update_categories(entries.entries(), categories)) {
+            std::cout << "✓ Categorized " << matched << " of " << entries.size()
+                      << " entries." << std::endl;
+        } else {
+            std::cout << "✗ Failed to categorize entries" << std::endl;
+        }
+    }
+
     void delete_entry(finance::Database& db,
             int id
             ){
@@ -1,10 +1,14 @@
 #include "database/database.h"
+#include "categorizer/categorizer.h"
 #include <string>
 #include <optional>
 
 namespace cli_handlers {
 
-    void add_entry(finance::Database& db, const std::string& month, const std::string& type);
+    void add_entry(finance::Database& db, const std::string& month, const std::string& type,
+            const finance::Categorizer* categorizer = nullptr);
+    void auto_categorize(finance::Database& db, const finance::Categorizer& categorizer,
+            const std::string& month);
     void delete_entry(finance::Database& db, int id);
     void edit_entry(finance::Database& db, int id,
             std::optional<std::string> type = std::nullopt,
@@ -0,0 +1,256 @@
+#include "categorizer.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <queue>
+#include <sstream>
+#include <thread>
+
+namespace finance {
+
+namespace {
+
+// Matches the width of the entries.category column.
+constexpr std::size_t max_category_length = 64;
+
+// Below this many entries per thread, spawning threads costs more than it saves.
+constexpr std::size_t min_entries_per_thread = 4096;
+
+char to_lower(char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+std::string trim(const std::string& s) {
+    const auto first = s.find_first_not_of(" \t\r");
+    if (first == std::string::npos) {
+        return "";
+    }
+    const auto last = s.find_last_not_of(" \t\r");
+    return s.substr(first, last - first + 1);
+}
+
+} // namespace
+
+std::vector<Rule> load_rules(const std::string& path) {
+    std::vector<Rule> rules;
+
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "Failed to open rules file: " << path << std::endl;
+        return rules;
+    }
+
+    std::string line;
+    int line_number = 0;
+    while (std::getline(file, line)) {
+        ++line_number;
+        line = trim(line);
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        const auto eq = line.rfind('=');
+        const auto space = line.find_first_of(" \t");
+        if (eq == std::string::npos || space == std::string::npos || space > eq) {
+            std::cerr << "Ignoring invalid rule on line " << line_number << std::endl;
+            continue;
+        }
+
+        const std::string kind = line.substr(0, space);
+        const std::string argument = trim(line.substr(space, eq - space));
+        Rule rule;
+        rule.category = trim(line.substr(eq + 1));
+
+        bool valid = !rule.category.empty() && rule.category.size() <= max_category_length
+                  && !argument.empty();
+        if (kind == "keyword" || kind == "prefix") {
+            rule.kind = kind == "keyword" ? RuleKind::Keyword : RuleKind::Prefix;
+            rule.pattern = argument;
+        } else if (kind == "amount") {
+            rule.kind = RuleKind::AmountRange;
+            std::istringstream range(argument);
+            valid = valid && (range >> rule.min_value >> rule.max_value)
+                          && rule.min_value <= rule.max_value;
+        } else {
+            valid = false;
+        }
+
+        if (!valid) {
+            std::cerr << "Ignoring invalid rule on line " << line_number << std::endl;
+            continue;
+        }
+        rules.push_back(std::move(rule));
+    }
+
+    return rules;
+}
+
+Categorizer::Categorizer(std::vector<Rule> rules) : rules_(std::move(rules)) {
+    build();
+}
+
+void Categorizer::build() {
+    // Deduplicate patterns so keyword and prefix rules on the same text
+    // share one automaton output.
+    std::map<std::string, std::int32_t> pattern_index;
+    for (std::size_t i = 0; i < rules_.size(); ++i) {
+        const Rule& rule = rules_[i];
+        if (rule.kind == RuleKind::AmountRange) {
+            amount_rules_.push_back(static_cast<std::int32_t>(i));
+            continue;
+        }
+        if (rule.pattern.empty()) {
+            continue;
+        }
+
+        std::string lowered(rule.pattern.size(), '\0');
+        std::transform(rule.pattern.begin(), rule.pattern.end(), lowered.begin(), to_lower);
+
+        auto [it, inserted] = pattern_index.try_emplace(
+            lowered, static_cast<std::int32_t>(patterns_.size()));
+        if (inserted) {
+            patterns_.push_back(Pattern{lowered.size(), {}});
+            for (char c : lowered) {
+                auto& symbol = symbol_[static_cast<unsigned char>(c)];
+                if (symbol == 0) {
+                    symbol = static_cast<std::uint16_t>(symbols_++);
+                }
+            }
+        }
+        patterns_[it->second].rules.push_back(static_cast<std::int32_t>(i));
+    }
+
+    // Fold upper case onto the lower case symbols.
+    for (char c = 'A'; c <= 'Z'; ++c) {
+        symbol_[static_cast<unsigned char>(c)] = symbol_[static_cast<unsigned char>(to_lower(c))];
+    }
+
+    // Trie.
+    transitions_.assign(symbols_, no_match);
+    output_.assign(1, no_match);
+    for (const auto& [text, index] : pattern_index) {
+        std::int32_t state = 0;
+        for (char c : text) {
+            const std::size_t slot = state * symbols_ + symbol_[static_cast<unsigned char>(c)];
+            if (transitions_[slot] == no_match) {
+                transitions_[slot] = static_cast<std::int32_t>(output_.size());
+                transitions_.resize(transitions_.size() + symbols_, no_match);
+                output_.push_back(no_match);
+            }
+            state = transitions_[slot];
+        }
+        output_[state] = index;
+    }
+
+    // Breadth-first pass turning the trie into a full DFA and linking each
+    // state to the nearest proper suffix that ends a pattern.
+    std::vector<std::int32_t> fail(output_.size(), 0);
+    dict_link_.assign(output_.size(), no_match);
+    std::queue<std::int32_t> pending;
+
+    for (std::size_t s = 0; s < symbols_; ++s) {
+        std::int32_t& next = transitions_[s];
+        if (next == no_match) {
+            next = 0;
+        } else {
+            pending.push(next);
+        }
+    }
+
+    while (!pending.empty()) {
+        const std::int32_t state = pending.front();
+        pending.pop();
+
+        const std::int32_t suffix = fail[state];
+        dict_link_[state] = output_[suffix] != no_match ? suffix : dict_link_[suffix];
+
+        for (std::size_t s = 0; s < symbols_; ++s) {
+            std::int32_t& next = transitions_[state * symbols_ + s];
+            const std::int32_t fallback = transitions_[suffix * symbols_ + s];
+            if (next == no_match) {
+                next = fallback;
+            } else {
+                fail[next] = fallback;
+                pending.push(next);
+            }
+        }
+    }
+}
+
+std::string_view Categorizer::classify(std::string_view name, double value) const {
+    std::int32_t best = std::numeric_limits<std::int32_t>::max();
+
+    for (std::int32_t index : amount_rules_) {
+        const Rule& rule = rules_[index];
+        if (value >= rule.min_value && value <= rule.max_value) {
+            best = index;
+            break;
+        }
+    }
+
+    std::int32_t state = 0;
+    for (std::size_t i = 0; i < name.size() && best != 0; ++i) {
+        state = transitions_[state * symbols_ + symbol_[static_cast<unsigned char>(name[i])]];
+
+        std::int32_t match = output_[state] != no_match ? state : dict_link_[state];
+        for (; match != no_match; match = dict_link_[match]) {
+            const Pattern& pattern = patterns_[output_[match]];
+            for (std::int32_t index : pattern.rules) {
+                if (index >= best) {
+                    break;
+                }
+                if (rules_[index].kind == RuleKind::Prefix && i + 1 != pattern.length) {
+                    continue;
+                }
+                best = index;
+                break;
+            }
+        }
+    }
+
+    if (best == std::numeric_limits<std::int32_t>::max()) {
+        return {};
+    }
+    return rules_[best].category;
+}
+
+std::vector<std::string_view> Categorizer::classify_all(std::span<const Entry> entries,
+                                                        unsigned threads) const {
+    std::vector<std::string_view> categories(entries.size());
+
+    auto classify_range = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            categories[i] = classify(entries[i].name, entries[i].value);
+        }
+    };
+
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    const std::size_t max_threads =
+        (entries.size() + min_entries_per_thread - 1) / min_entries_per_thread;
+    const std::size_t workers = std::min<std::size_t>(threads, max_threads);
+
+    if (workers <= 1) {
+        classify_range(0, entries.size());
+        return categories;
+    }
+
+    const std::size_t chunk = (entries.size() + workers - 1) / workers;
+    {
+        std::vector<std::jthread> pool;
+        pool.reserve(workers - 1);
+        for (std::size_t w = 1; w < workers; ++w) {
+            const std::size_t begin = w * chunk;
+            const std::size_t end = std::min(entries.size(), begin + chunk);
+            pool.emplace_back(classify_range, begin, end);
+        }
+        classify_range(0, std::min(entries.size(), chunk));
+    }
+
+    return categories;
+}
+
+} // namespace finance
@@ -0,0 +1,76 @@
+#pragma once
+#include "database/database.h"
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace finance {
+
+enum class RuleKind {
+    Keyword,     // pattern appears anywhere in the name
+    Prefix,      // name starts with pattern
+    AmountRange  // value lies in [min_value, max_value]
+};
+
+struct Rule {
+    RuleKind kind = RuleKind::Keyword;
+    std::string pattern;    // Keyword/Prefix only, matched case-insensitively
+    double min_value = 0.0; // AmountRange only
+    double max_value = 0.0; // AmountRange only
+    std::string category;
+};
+
+// Load rules from a text file, one rule per line:
+//   keyword <pattern> = <category>
+//   prefix <pattern> = <category>
+//   amount <min> <max> = <category>
+// Blank lines and lines starting with '#' are ignored.
+std::vector<Rule> load_rules(const std::string& path);
+
+// Compiles a rule set into a single Aho-Corasick automaton so each name is
+// classified in one pass regardless of how many rules there are.
+// When several rules match, the one listed first wins.
+class Categorizer {
+public:
+    explicit Categorizer(std::vector<Rule> rules);
+
+    // Empty view if no rule matches. Views into this categorizer's rules.
+    std::string_view classify(std::string_view name, double value) const;
+
+    // Classify every entry, split across threads (0 = one per core).
+    std::vector<std::string_view> classify_all(std::span<const Entry> entries,
+                                               unsigned threads = 0) const;
+
+    bool empty() const { return rules_.empty(); }
+
+private:
+    static constexpr std::int32_t no_match = -1;
+
+    struct Pattern {
+        std::size_t length;
+        std::vector<std::int32_t> rules; // ascending rule indexes
+    };
+
+    std::vector<Rule> rules_;
+    std::vector<Pattern> patterns_;
+    std::vector<std::int32_t> amount_rules_; // ascending rule indexes
+
+    // Byte -> symbol, folding ASCII case and collapsing bytes not used by
+    // any pattern into symbol 0 to keep the transition table small.
+    std::array<std::uint16_t, 256> symbol_{};
+    std::size_t symbols_ = 1;
+
+    // Dense DFA: transitions_[state * symbols_ + symbol].
+    std::vector<std::int32_t> transitions_;
+    // Pattern ending at each state (or no_match), and the next state on the
+    // suffix-link chain that also ends a pattern.
+    std::vector<std::int32_t> output_;
+    std::vector<std::int32_t> dict_link_;
+
+    void build();
+};
+
+} // namespace finance
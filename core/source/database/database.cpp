@@ -1,9 +1,52 @@
 #include "database.h"
 #include <iostream>
 #include <sstream>
+#include <utility>
 
 namespace finance {
 
+namespace {
+
+// Column positions of an entries query, resolved once per result so rows
+// can be decoded by index instead of by name.
+struct EntryColumns {
+    pqxx::row::size_type id;
+    pqxx::row::size_type month;
+    pqxx::row::size_type type;
+    pqxx::row::size_type name;
+    pqxx::row::size_type value;
+    pqxx::row::size_type category;
+    pqxx::row::size_type created_at;
+
+    explicit EntryColumns(const pqxx::result& res)
+        : id(res.column_number("id")),
+          month(res.column_number("month")),
+          type(res.column_number("type")),
+          name(res.column_number("name")),
+          value(res.column_number("value")),
+          category(res.column_number("category")),
+          created_at(res.column_number("created_at")) {}
+};
+
+} // namespace
+
+EntryList::EntryList(pqxx::result res) : res_(std::move(res)) {
+    const EntryColumns cols(res_);
+    entries_.reserve(res_.size());
+
+    for (const auto& row : res_) {
+        entries_.push_back(Entry{
+            row[cols.id].as<int>(),
+            row[cols.month].view(),
+            row[cols.type].view(),
+            row[cols.name].view(),
+            row[cols.value].as<double>(),
+            row[cols.category].view(),
+            row[cols.created_at].view(),
+        });
+    }
+}
+
 // In database.cpp
 Database::Database(const std::string& connection_string) {
     std::cout << "Database constructor called" << std::endl;
@@ -28,10 +71,13 @@ void Database::initialize() {
                 type VARCHAR(10) NOT NULL CHECK (type IN ('expense', 'income', 'account_state')),
                 name VARCHAR(255) NOT NULL,
                 value DECIMAL(10, 2) NOT NULL,
+                category VARCHAR(64),
                 created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP
             )
         )");
         
+        txn.exec("ALTER TABLE entries ADD COLUMN IF NOT EXISTS category VARCHAR(64)");
+
         txn.exec("CREATE INDEX IF NOT EXISTS idx_entries_month ON entries(month)");
         txn.exec("CREATE INDEX IF NOT EXISTS idx_entries_type ON entries(type)");
         
@@ -43,30 +89,20 @@ void Database::initialize() {
     }
 }
 
-std::vector<Entry> Database::entry_info(int id) {
-    std::vector<Entry> entries;
+EntryList Database::entry_info(int id) {
+    EntryList entries;
     
     try {
         pqxx::work txn(*conn_);
         
         pqxx::result res = txn.exec(
-            "SELECT id, month, type, name, value, created_at FROM entries WHERE id = $1 ORDER BY created_at DESC",
+            "SELECT id, month, type, name, value, category, created_at FROM entries WHERE id = $1 ORDER BY created_at DESC",
             // std::vector<std::string>{month}
             pqxx::params(id)
         );
         
-        for (const auto& row : res) {
-            Entry entry;
-            entry.id = row["id"].as<int>();
-            entry.month = row["month"].as<std::string>();
-            entry.type = row["type"].as<std::string>();
-            entry.name = row["name"].as<std::string>();
-            entry.value = row["value"].as<double>();
-            entry.created_at = row["created_at"].as<std::string>();
-            entries.push_back(entry);
-        }
-        
         txn.commit();
+        entries = EntryList(std::move(res));
     } catch (const std::exception& e) {
         std::cerr << "Failed to retrieve entry information: " << e.what() << std::endl;
     }
@@ -76,12 +112,13 @@ std::vector<Entry> Database::entry_info(int id) {
 
 
 bool Database::add_entry(const std::string& month, const std::string& type,
-                         const std::string& name, double value) {
+                         const std::string& name, double value,
+                         const std::string& category) {
     try {
         pqxx::work txn(*conn_);
         
-        std::string query = "INSERT INTO entries (month, type, name, value) VALUES ($1, $2, $3, $4)";
-        txn.exec(query, {month, type, name, value});
+        std::string query = "INSERT INTO entries (month, type, name, value, category) VALUES ($1, $2, $3, $4, NULLIF($5, ''))";
+        txn.exec(query, {month, type, name, value, category});
         
         txn.commit();
         return true;
@@ -159,30 +196,43 @@ bool Database::update_value(const int id, const double value){
     return true;
 }
 
-std::vector<Entry> Database::get_entries_by_month(const std::string& month) {
-    std::vector<Entry> entries;
+bool Database::update_categories(std::span<const Entry> entries,
+                                 const std::vector<std::string_view>& categories) {
+    try {
+        std::vector<int> ids;
+        ids.reserve(entries.size());
+        for (const auto& entry : entries) {
+            ids.push_back(entry.id);
+        }
+
+        pqxx::work txn(*conn_);
+        txn.exec(
+            "UPDATE entries AS e SET category = NULLIF(u.category, '') "
+            "FROM unnest($1::int[], $2::text[]) AS u(id, category) WHERE e.id = u.id",
+            pqxx::params(ids, categories)
+        );
+        txn.commit();
+        return true;
+    } catch (const std::exception& e) {
+        std::cerr << "Failed to update categories: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+EntryList Database::get_entries_by_month(const std::string& month) {
+    EntryList entries;
     
     try {
         pqxx::work txn(*conn_);
         
         pqxx::result res = txn.exec(
-            "SELECT id, month, type, name, value, created_at FROM entries WHERE month = $1 ORDER BY created_at DESC",
+            "SELECT id, month, type, name, value, category, created_at FROM entries WHERE month = $1 ORDER BY created_at DESC",
             // std::vector<std::string>{month}
             pqxx::params(month)
         );
         
-        for (const auto& row : res) {
-            Entry entry;
-            entry.id = row["id"].as<int>();
-            entry.month = row["month"].as<std::string>();
-            entry.type = row["type"].as<std::string>();
-            entry.name = row["name"].as<std::string>();
-            entry.value = row["value"].as<double>();
-            entry.created_at = row["created_at"].as<std::string>();
-            entries.push_back(entry);
-        }
-        
         txn.commit();
+        entries = EntryList(std::move(res));
     } catch (const std::exception& e) {
         std::cerr << "Failed to retrieve entries: " << e.what() << std::endl;
     }
@@ -232,4 +282,36 @@ double Database::get_total_expenses(const std::string& month) {
     return 0.0;
 }
 
+std::vector<CategoryTotal> Database::get_category_totals(const std::string& month) {
+    std::vector<CategoryTotal> totals;
+
+    try {
+        pqxx::work txn(*conn_);
+
+        pqxx::result res = txn.exec(
+            "SELECT COALESCE(category, '') AS category, "
+            "COALESCE(SUM(value) FILTER (WHERE type = 'income'), 0) AS income, "
+            "COALESCE(SUM(value) FILTER (WHERE type = 'expense'), 0) AS expenses "
+            "FROM entries WHERE month = $1 AND type IN ('income', 'expense') "
+            "GROUP BY 1 ORDER BY expenses DESC, income DESC",
+            pqxx::params(month)
+        );
+
+        txn.commit();
+
+        totals.reserve(res.size());
+        for (const auto& row : res) {
+            totals.push_back(CategoryTotal{
+                row[0].as<std::string>(),
+                row[1].as<double>(),
+                row[2].as<double>(),
+            });
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Failed to get category totals: " << e.what() << std::endl;
+    }
+
+    return totals;
+}
+
 } // namespace finance
@@ -1,18 +1,55 @@
 #pragma once
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <memory>
 #include <pqxx/pqxx>
 
 namespace finance {
 
+// Text fields view into the query result owned by the EntryList the
+// entry came from, so they are only valid while that list is alive.
 struct Entry {
     int id;
-    std::string month;      // Format: YYYY-MM-01
-    std::string type;       // "expense" or "income"
-    std::string name;
+    std::string_view month;      // Format: YYYY-MM-01
+    std::string_view type;       // "expense" or "income"
+    std::string_view name;
     double value;
-    std::string created_at;
+    std::string_view category;   // Empty when uncategorized
+    std::string_view created_at;
+};
+
+struct CategoryTotal {
+    std::string category;        // Empty for uncategorized entries
+    double income;
+    double expenses;
+};
+
+// Entries decoded from a single query. Owns the underlying result buffer
+// that the entries' string views point into, hence move-only.
+class EntryList {
+public:
+    EntryList() = default;
+    explicit EntryList(pqxx::result res);
+
+    EntryList(const EntryList&) = delete;
+    EntryList& operator=(const EntryList&) = delete;
+    EntryList(EntryList&&) noexcept = default;
+    EntryList& operator=(EntryList&&) noexcept = default;
+
+    bool empty() const { return entries_.empty(); }
+    std::size_t size() const { return entries_.size(); }
+    const Entry& operator[](std::size_t i) const { return entries_[i]; }
+
+    std::vector<Entry>::const_iterator begin() const { return entries_.begin(); }
+    std::vector<Entry>::const_iterator end() const { return entries_.end(); }
+
+    std::span<const Entry> entries() const { return entries_; }
+
+private:
+    pqxx::result res_;
+    std::vector<Entry> entries_;
 };
 
 class Database {
@@ -24,25 +61,31 @@ public:
 
     // Add an entry
     bool add_entry(const std::string& month, const std::string& type, 
-                   const std::string& name, double value);
+                   const std::string& name, double value,
+                   const std::string& category = "");
 
     bool delete_entry(const int id);
 
     // Check entry
     bool entry_exists(const int id, std::string& month);
-    std::vector<Entry> entry_info(int id);
+    EntryList entry_info(int id);
 
     // Edit
     bool update_type(const int id, const std::string& type);
     bool update_name(const int id, const std::string& name);
     bool update_value(const int id, const double value);
 
+    // Set categories[i] on entries[i] in a single statement
+    bool update_categories(std::span<const Entry> entries,
+                           const std::vector<std::string_view>& categories);
+
     // Get all entries for a specific month
-    std::vector<Entry> get_entries_by_month(const std::string& month);
+    EntryList get_entries_by_month(const std::string& month);
 
     // Get summary for a month
     double get_total_income(const std::string& month);
     double get_total_expenses(const std::string& month);
+    std::vector<CategoryTotal> get_category_totals(const std::string& month);
 
 private:
     std::unique_ptr<pqxx::connection> conn_;
@@ -4,6 +4,7 @@ CREATE TABLE IF NOT EXISTS entries (
     type VARCHAR(10) NOT NULL CHECK (type IN ('expense', 'income')),
     name VARCHAR(255) NOT NULL,
     value DECIMAL(10, 2) NOT NULL,
+    category VARCHAR(64),
     created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP
 );
 